@@ -3,13 +3,19 @@
  *
  * This file contains comprehensive tests for the CUSFAM DLL library,
  * including initialization, steady-state calculations, xenon dynamics,
- * shutdown margin analysis, and flexible operations.
+ * shutdown margin analysis, flexible operations, and concurrent
+ * independent engine instances.
  */
 
 #include "CusfamDll.h"
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
 
 using namespace dnegri::cusfam::dll;
 using namespace std;
@@ -431,18 +437,264 @@ void testFlexibleOperation() {
     }
 }
 
+/**
+ * @brief Run one independent case on its own CUSFAM engine
+ * @param baseOption Fully initialized calculation options shared by all cases
+ * @param plevel Power level as fraction of nominal for this case
+ * @return Steady-state result followed by one result per xenon dynamics step
+ *
+ * Helper for the concurrency test. Every call creates, initializes and
+ * solves a separate Cusfam object, then steps a XenonDynamicsOperation
+ * on that engine, so that no engine or operation state is shared.
+ * Only plevel differs from baseOption, so the serial and concurrent
+ * runs of a case get identical inputs.
+ */
+vector<CusfamResult> runIndependentCase(const SteadyOption& baseOption, double plevel) {
+    Cusfam cusfam;
+    cusfam.initialize("./run/skn3/c01/S301NOMDEP.SMG",
+                      "./run/skn3/PLUS7_V127.XS",
+                      "./run/skn3/PLUS7_V127.FF");
+
+    vector<double> burnupPoints = {0.0, 50.0, 500.0, 1000.0, 2000.0};
+    cusfam.setBurnupPoints(burnupPoints);
+    cusfam.setNumberOfThreads(1); ///< One solver thread per engine
+
+    cusfam.setControlRod("P");
+    cusfam.setControlRod("R3");
+    cusfam.setControlRod("R4");
+    cusfam.setControlRod("R5");
+
+    SteadyOption option = baseOption;
+    option.plevel       = plevel;
+
+    vector<CusfamResult> results;
+
+    // Steady state with depletion
+    cusfam.setBurnup("./run/skn3/c01/S301NOMDEP", burnupPoints[0], option);
+    cusfam.calcStatic(option);
+    cusfam.deplete(XEType::XE_EQ, SMType::SM_TR, burnupPoints[1] - burnupPoints[0]);
+    cusfam.calcStatic(option);
+    results.push_back(cusfam.getResult());
+
+    // Xenon dynamics steps on the same engine
+    XenonDynamicsOperation xenonOp(cusfam);
+    xenonOp.setTime(3600.0 * 24, 3600.0); ///< 24 hours simulation, 1 hour time steps
+    xenonOp.setXenonFactor(1.0);
+    xenonOp.reset();
+
+    int step = 0;
+    while (xenonOp.next() && step < 3) { ///< First 3 time steps only
+        results.push_back(xenonOp.runStep(option));
+        step++;
+    }
+
+    return results;
+}
+
+/**
+ * @brief Relative difference between two values
+ * @param a First value
+ * @param b Second value
+ * @return |a - b| scaled by the larger magnitude (0 if both are zero)
+ */
+double relDifference(double a, double b) {
+    double scale = max(fabs(a), fabs(b));
+    return scale > 0.0 ? fabs(a - b) / scale : 0.0;
+}
+
+/**
+ * @brief Largest relative difference between two distributions
+ * @param a First distribution
+ * @param b Second distribution
+ * @return Maximum relative difference, or infinity if the sizes differ
+ */
+double maxRelDifference(const vector<double>& a, const vector<double>& b) {
+    if (a.size() != b.size()) return numeric_limits<double>::infinity();
+
+    double diff = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff = max(diff, relDifference(a[i], b[i]));
+    }
+    return diff;
+}
+
+/**
+ * @brief Describe how a result differs from its reference
+ * @param result Result to check
+ * @param reference Expected result
+ * @param tolerance Allowed relative difference per value
+ * @return Empty string if within tolerance, otherwise the differing fields
+ */
+string describeDifference(const CusfamResult& result, const CusfamResult& reference, double tolerance) {
+    ostringstream diff;
+    diff << scientific << setprecision(3);
+
+    double deigv  = relDifference(result.eigv, reference.eigv);
+    double dppm   = relDifference(result.ppm, reference.ppm);
+    double dpow2d = maxRelDifference(result.pow2d, reference.pow2d);
+    double dpow1d = maxRelDifference(result.pow1d, reference.pow1d);
+
+    if (deigv > tolerance) diff << " eigv rel|d|=" << deigv;
+    if (dppm > tolerance) diff << " ppm rel|d|=" << dppm;
+    if (dpow2d > tolerance) diff << " pow2d max rel|d|=" << dpow2d;
+    if (dpow1d > tolerance) diff << " pow1d max rel|d|=" << dpow1d;
+
+    return diff.str();
+}
+
+/**
+ * @brief Stress test for concurrent independent CUSFAM engines
+ *
+ * This test runs the same set of cases several ways:
+ * - Serially, one engine after another, to obtain reference results
+ * - Concurrently, one engine per thread, repeated several times
+ *
+ * Each case covers calcStatic, deplete and XenonDynamicsOperation::runStep.
+ * One case is run per hardware thread and the concurrent phase is repeated,
+ * so races on shared state get many chances to show up. Independent engines
+ * must not share hidden state, so every concurrent result of every repetition
+ * has to reproduce its serial reference within a 1e-10 relative tolerance.
+ * The tolerance absorbs reduction-order changes from vectorized code whose
+ * alignment depends on heap layout.
+ *
+ * Every engine holds its own XS/FF library, so this test is expensive and
+ * only runs when the program is started with --stress.
+ */
+void testConcurrentInstances() {
+    printSeparator("Concurrent Instances Test");
+
+    try {
+        const int    repetitions = 5;     ///< Number of concurrent passes
+        const double tolerance   = 1e-10; ///< Allowed relative difference
+
+        // Calculation options shared by every case, fully initialized
+        SteadyOption option{};
+        option.ppm          = 500.0;
+        option.tin          = 290.0;
+        option.shpmtch      = ShapeMatchOption::SHAPE_NO;
+        option.searchOption = CriticalOption::CBC;
+        option.xenon        = XEType::XE_EQ;
+        option.samarium     = SMType::SM_TR;
+        option.feedtm       = true;
+        option.feedtf       = true;
+        option.eigvt        = 1.00000;
+        option.epsiter      = 1.E-5;
+        option.maxiter      = 100;
+        option.b10a         = 1.0; ///< Nominal boron-10 absorption
+        option.time         = 0.0; ///< Steady state
+
+        option.rod_pos["P"]  = 381.0;
+        option.rod_pos["R5"] = 381.0;
+        option.rod_pos["R4"] = 381.0;
+        option.rod_pos["R3"] = 381.0;
+
+        // One case per hardware thread
+        unsigned int ncases = max(2u, thread::hardware_concurrency());
+
+        vector<double> plevels;
+        for (unsigned int i = 0; i < ncases; ++i) {
+            plevels.push_back(1.0 - 0.5 * i / ncases);
+        }
+
+        // Serial reference results
+        vector<vector<CusfamResult>> reference;
+        for (double plevel : plevels) {
+            reference.push_back(runIndependentCase(option, plevel));
+        }
+        cout << "✓ Serial reference for " << plevels.size() << " cases completed" << endl;
+
+        int mismatches = 0;
+        for (int rep = 0; rep < repetitions; ++rep) {
+            // Same cases with one engine per thread
+            vector<vector<CusfamResult>> concurrent(plevels.size());
+            vector<string>               errors(plevels.size());
+            vector<thread>               workers;
+            workers.reserve(plevels.size());
+
+            auto start = chrono::high_resolution_clock::now();
+            for (size_t i = 0; i < plevels.size(); ++i) {
+                try {
+                    workers.emplace_back([&, i]() {
+                        try {
+                            concurrent[i] = runIndependentCase(option, plevels[i]);
+                        } catch (const exception& e) {
+                            errors[i] = e.what();
+                        } catch (...) {
+                            errors[i] = "unknown exception";
+                        }
+                    });
+                } catch (const exception& e) {
+                    // Threads already started are joined below; the rest are reported
+                    for (size_t j = i; j < plevels.size(); ++j) {
+                        errors[j] = string("thread not started: ") + e.what();
+                    }
+                    break;
+                }
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            auto end = chrono::high_resolution_clock::now();
+
+            auto duration = chrono::duration_cast<chrono::milliseconds>(end - start);
+            cout << "✓ Concurrent pass " << rep << " completed in " << duration.count() << " ms" << endl;
+
+            // Compare every concurrent result against its serial reference
+            for (size_t i = 0; i < plevels.size(); ++i) {
+                if (!errors[i].empty()) {
+                    cout << "✗ Pass " << rep << " case " << i << " failed: " << errors[i] << endl;
+                    ++mismatches;
+                    continue;
+                }
+
+                if (concurrent[i].size() != reference[i].size()) {
+                    cout << "✗ Pass " << rep << " case " << i << " ran " << concurrent[i].size()
+                         << " steps instead of " << reference[i].size() << endl;
+                    ++mismatches;
+                    continue;
+                }
+
+                for (size_t s = 0; s < reference[i].size(); ++s) {
+                    string diff = describeDifference(concurrent[i][s], reference[i][s], tolerance);
+                    if (!diff.empty()) {
+                        cout << "✗ Pass " << rep << " case " << i << " step " << s
+                             << " differs from serial reference:" << diff << endl;
+                        ++mismatches;
+                    }
+                }
+            }
+        }
+
+        if (mismatches == 0) {
+            cout << "✓ All " << repetitions << " concurrent passes match the serial reference" << endl;
+        } else {
+            cout << "✗ " << mismatches << " mismatches across " << repetitions << " passes" << endl;
+        }
+
+    } catch (const exception& e) {
+        cout << "✗ Error in concurrent instances test: " << e.what() << endl;
+    }
+}
+
 /**
  * @brief Main test program entry point
+ * @param argc Number of command-line arguments
+ * @param argv Command-line arguments (--stress enables the concurrency stress test)
  *
  * Executes all CUSFAM DLL tests in sequence and reports overall results.
  * Times the execution of all tests and provides a summary.
  *
  * @return 0 on successful completion, non-zero on error
  */
-int main() {
+int main(int argc, char* argv[]) {
     cout << "=== CUSFAM DLL Test Program ===" << endl;
     cout << "Built on " << __DATE__ << " at " << __TIME__ << endl;
 
+    bool stress = false; ///< Run the concurrency stress test
+    for (int i = 1; i < argc; ++i) {
+        if (string(argv[i]) == "--stress") stress = true;
+    }
+
     // Record start time for performance measurement
     auto start_time = chrono::high_resolution_clock::now();
 
@@ -452,6 +704,9 @@ int main() {
     testXenonDynamics();          ///< Test xenon transient simulation
     testShutdownMargin();         ///< Test shutdown margin analysis
     testFlexibleOperation();      ///< Test flexible power maneuvering
+    if (stress) {
+        testConcurrentInstances(); ///< Test concurrent independent engines (opt-in)
+    }
     // testCInterface();          ///< C interface test (commented out for this run)
 
     // Calculate and display total execution time